@@ -1,4 +1,5 @@
 #include "buchberger.h"
+#include "trace.h"
 #include <algorithm>
 
 bool decreasing_leading_term::operator()(const polynomial& p, const polynomial& q) const
@@ -23,6 +24,7 @@ void reduce_mod(polynomial& p, const polynomial& q)
     int q_deg = q.degree();
     if (q_deg < 0)
         return;
+    TRACE_SCOPE_IF(p.degree() - q_deg + 1 >= trace::reduce_mod_min_steps, "reduce_mod");
     Z q_leading_coeff = q.coefficient(q_deg);
 
     int initial_p_deg = p.degree();
@@ -35,14 +37,33 @@ void reduce_mod(polynomial& p, const polynomial& q)
     }
 }
 
+// If b contains a nonzero constant n, then <c f, n> = <gcd(c, n) f, n>:
+// writing c = g c', n = g n' with u c' + v n' = 1, we get
+// g f = u (c f) + v f n.  So p can be replaced by gcd(content, n) times
+// its primitive part without changing the ideal.
+void reduce_content(polynomial& p, const ideal_basis& b)
+{
+    if (b.empty() || b.rbegin()->degree() != 0)
+        return;
+    Z c = p.content();
+    if (c <= 1)
+        return;
+    Z g = gcd(c, b.rbegin()->coefficient(0));
+    if (g != c)
+        p.divide_exact(c / g);
+}
+
 bool buchberger_search(ideal_basis& b)
 {
+    TRACE_SCOPE("buchberger_search");
+
     // First try modding out any entry by following entries
     for (auto i = b.begin(); i != b.end(); ++i) {
         auto p = *i;
         for (auto j = std::next(i); j != b.end(); ++j) {
             reduce_mod(p, *j);
         }
+        reduce_content(p, b);
         if (p != *i) {
             if (p.leading_coefficient() < 0)
                 p.negate();
@@ -64,6 +85,7 @@ bool buchberger_search(ideal_basis& b)
             if (p != polynomial {}) {
                 if (p.leading_coefficient() < 0)
                     p.negate();
+                reduce_content(p, b);
                 b.insert(std::move(p));
                 return true;
             }
@@ -88,6 +110,32 @@ void buchberger(ideal_basis& b)
         b.insert(std::move(minus_p));
     }
 
+    // If all generators share a common factor c, the ideal is c times the
+    // ideal generated by the quotients, and so is its reduced basis.
+    Z common = 0;
+    for (const auto& p : b) {
+        common = gcd(common, p.content());
+        if (common == 1)
+            break;
+    }
+    if (common > 1) {
+        ideal_basis quotients;
+        for (auto p : b) {
+            p.divide_exact(common);
+            quotients.insert(std::move(p));
+        }
+        b = std::move(quotients);
+    }
+
     while (buchberger_search(b))
         ;
+
+    if (common > 1) {
+        ideal_basis multiples;
+        for (auto p : b) {
+            p *= common;
+            multiples.insert(std::move(p));
+        }
+        b = std::move(multiples);
+    }
 }
@@ -9,4 +9,9 @@ struct decreasing_leading_term {
 
 using ideal_basis = std::set<polynomial, decreasing_leading_term>;
 
+// Replace p by its remainder modulo q.  If p is reduced in turn by every
+// element of a Groebner basis, in order, the result is 0 exactly when p
+// lies in the ideal.
+void reduce_mod(polynomial& p, const polynomial& q);
+
 void buchberger(ideal_basis& b);
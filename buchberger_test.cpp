@@ -77,6 +77,15 @@ TEST(Buchberger, Buchberger)
     EXPECT_EQ(buchberger_of({ { 1, 1, 0 }, { 4, 4 } }),
         (ideal_basis { { 1, 1, 0 }, { 4, 4 } }));
 
+    EXPECT_EQ(buchberger_of({ { 6, 18, 12 }, { 24, 24 } }),
+        (ideal_basis { { 6, 18, 12 }, { 24, 24 } }));
+    EXPECT_EQ(buchberger_of({ { 5, 5, 0 }, { 20, -15 } }),
+        (ideal_basis { { 5, 75 }, { 105 } }));
+    EXPECT_EQ(buchberger_of({ { 3, 6, 9 }, { 2 } }),
+        (ideal_basis { { 1, 0, 1 }, { 2 } }));
+    EXPECT_EQ(buchberger_of({ { 6, 0, 12 }, { 4 } }),
+        (ideal_basis { { 2, 0, 0 }, { 4 } }));
+
     // representation of <2+3i> in Z[i]
     EXPECT_EQ(buchberger_of({ { 1, 0, 1 }, { 3, 2 } }),
         (ideal_basis { { 1, 5 }, { 13 } }));
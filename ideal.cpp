@@ -0,0 +1,158 @@
+#include "ideal.h"
+#include "integer_matrix.h"
+#include "macaulay.h"
+
+namespace ideal_details {
+
+// Reduce p in turn by every element of the reduced basis b and make its
+// leading coefficient positive; the result is 0 exactly when p lies in
+// the ideal generated by b.
+void reduce_by_basis(polynomial& p, const ideal_basis& b)
+{
+    for (const auto& q : b)
+        reduce_mod(p, q);
+    if (p != polynomial {} && p.leading_coefficient() < 0)
+        p.negate();
+}
+
+// Add generators to the reduced basis b, skipping those already in the
+// ideal, and bring the result back to a reduced basis.
+template <typename Iterator>
+void add_generators(ideal_basis& b, Iterator first, Iterator last)
+{
+    ideal_basis result = b;
+    bool changed = false;
+    for (; first != last; ++first) {
+        polynomial p = *first;
+        reduce_by_basis(p, b);
+        if (p != polynomial {}) {
+            result.insert(std::move(p));
+            changed = true;
+        }
+    }
+    if (changed) {
+        groebner_basis(result);
+        b = std::move(result);
+    }
+}
+
+void fill_row(Z* row, const polynomial& p, int shift, int degree_bound)
+{
+    for (int d = 0; d <= p.degree(); ++d)
+        row[degree_bound - shift - d] = p.coefficient(d);
+}
+
+} // namespace ideal_details
+
+ideal_basis ideal_sum(const ideal_basis& i, const ideal_basis& j)
+{
+    if (i.size() < j.size())
+        return ideal_sum(j, i);
+    ideal_basis result = i;
+    ideal_details::add_generators(result, j.begin(), j.end());
+    return result;
+}
+
+ideal_basis ideal_product(const ideal_basis& i, const ideal_basis& j)
+{
+    if (i.empty() || j.empty())
+        return {};
+
+    // All the products are independent, so they can be computed in parallel.
+    std::vector<polynomial> fs { i.begin(), i.end() };
+    std::vector<polynomial> gs { j.begin(), j.end() };
+    std::vector<polynomial> products(fs.size() * gs.size());
+    std::size_t work = (fs.front().degree() + 1) * (gs.front().degree() + 1);
+    integer_matrix_details::parallel_for(products.size(), work, [&](std::size_t k) {
+        products[k] = fs[k / gs.size()] * gs[k % gs.size()];
+    });
+
+    // For any f, the products f g over the elements g of a reduced basis
+    // already form a Groebner basis of f j (though not necessarily a
+    // reduced one).  Start with that for the lowest degree f, which is
+    // often a constant, so that the basis contains a constant from the
+    // start and the coefficients of everything added later stay small.
+    // Then add the other rows one at a time, dropping the products which
+    // are already in the ideal before buchberger() sees them.
+    auto row = [&](std::size_t k) { return products.begin() + k * gs.size(); };
+    std::size_t last = fs.size() - 1;
+    ideal_basis result { row(last), row(last + 1) };
+    buchberger(result);
+    for (std::size_t k = last; k-- > 0;)
+        ideal_details::add_generators(result, row(k), row(k + 1));
+    return result;
+}
+
+ideal_basis ideal_intersection(const ideal_basis& i, const ideal_basis& j)
+{
+    if (i.empty() || j.empty())
+        return {};
+
+    // Since i and j are Groebner bases, the polynomials of degree at most D
+    // in each ideal are exactly the integer combinations of the shifts
+    // x^k f of the basis elements f of that degree.  With the rows
+    // (x^k f, x^k f) for i and (x^k g, 0) for j, the rows of the Hermite
+    // normal form which vanish in the first half then carry a lattice basis
+    // of the intersection in the second half.
+    //
+    // It suffices to go up to D = d + e, the sum of the largest degrees of
+    // the two bases.  Let f and g be the elements of degree d and e, with
+    // leading coefficients a and b, and m = lcm(a, b).  The leading
+    // coefficients of degree at least max(d, e) are multiples of a in i,
+    // of b in j, so of m in the intersection.  Now
+    //   w = (m / a) x^e f - (m / b) x^d g
+    // has degree less than D and lies in i + j.  Buchberger's algorithm
+    // on i and j together never raises a degree beyond the larger of the
+    // two elements involved, so w = u + v with u in i and v in j both of
+    // degree less than D.  Then (m / a) x^e f - u = (m / b) x^d g + v has
+    // degree D and leading coefficient m, and lies in the intersection.
+    // So any element of larger degree can be reduced by a shift of it, and
+    // the intersection is generated by its elements of degree at most D.
+    int degree_bound = i.begin()->degree() + j.begin()->degree();
+    std::size_t cols = degree_bound + 1;
+    std::size_t nrows = 0;
+    for (const auto* b : { &i, &j })
+        for (const auto& f : *b)
+            nrows += degree_bound - f.degree() + 1;
+
+    integer_matrix m(nrows, 2 * cols);
+    std::size_t r = 0;
+    for (const auto& f : i) {
+        for (int k = 0; k <= degree_bound - f.degree(); ++k, ++r) {
+            ideal_details::fill_row(m.row(r), f, k, degree_bound);
+            ideal_details::fill_row(m.row(r) + cols, f, k, degree_bound);
+        }
+    }
+    for (const auto& g : j) {
+        for (int k = 0; k <= degree_bound - g.degree(); ++k, ++r)
+            ideal_details::fill_row(m.row(r), g, k, degree_bound);
+    }
+
+    std::size_t rank = m.hermite_normal_form();
+    ideal_basis result;
+    for (r = 0; r < rank; ++r) {
+        const Z* row = m.row(r);
+        if (std::all_of(row, row + cols, [](const Z& z) { return z == 0; }))
+            result.insert(polynomial { std::vector<Z>(row + cols, row + 2 * cols) });
+    }
+    buchberger(result);
+    return result;
+}
+
+ideal_basis ideal_colon(const ideal_basis& i, const Z& c)
+{
+    if (c == 0)
+        return ideal_basis { { 1 } };
+    if (i.empty())
+        return {};
+
+    // (i : c) is (i intersect <c>) / c, and dividing every element of a
+    // reduced basis by a common factor leaves a reduced basis.
+    Z n = abs(c);
+    ideal_basis result;
+    for (auto p : ideal_intersection(i, { { n } })) {
+        p.divide_exact(n);
+        result.insert(std::move(p));
+    }
+    return result;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "buchberger.h"
+
+// Arithmetic on ideals of Z[x].  The arguments must be reduced bases, as
+// computed by buchberger() or groebner_basis(), and so are the results.
+
+ideal_basis ideal_sum(const ideal_basis& i, const ideal_basis& j);
+ideal_basis ideal_product(const ideal_basis& i, const ideal_basis& j);
+ideal_basis ideal_intersection(const ideal_basis& i, const ideal_basis& j);
+
+// The ideal quotient (i : c) = { f : c f in i }.
+ideal_basis ideal_colon(const ideal_basis& i, const Z& c);
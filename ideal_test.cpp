@@ -0,0 +1,48 @@
+#include "ideal.h"
+#include <gtest/gtest.h>
+
+TEST(Ideal, Sum)
+{
+    EXPECT_EQ(ideal_sum({}, {}), ideal_basis {});
+    EXPECT_EQ(ideal_sum({ { 2 } }, {}), (ideal_basis { { 2 } }));
+    EXPECT_EQ(ideal_sum({}, { { 2 } }), (ideal_basis { { 2 } }));
+    EXPECT_EQ(ideal_sum({ { 2 } }, { { 3 } }), (ideal_basis { { 1 } }));
+    EXPECT_EQ(ideal_sum({ { 1, 0 } }, { { 2 } }), (ideal_basis { { 1, 0 }, { 2 } }));
+    EXPECT_EQ(ideal_sum({ { 1, 1, 0 } }, { { 4, -3 } }),
+        (ideal_basis { { 1, 15 }, { 21 } }));
+    EXPECT_EQ(ideal_sum({ { 1, 15 }, { 21 } }, { { 1, 1, 0 } }),
+        (ideal_basis { { 1, 15 }, { 21 } }));
+}
+
+TEST(Ideal, Product)
+{
+    EXPECT_EQ(ideal_product({}, { { 2 } }), ideal_basis {});
+    EXPECT_EQ(ideal_product({ { 2 } }, { { 3 } }), (ideal_basis { { 6 } }));
+    EXPECT_EQ(ideal_product({ { 1, 0 }, { 2 } }, { { 1, 0 }, { 2 } }),
+        (ideal_basis { { 1, 0, 0 }, { 2, 0 }, { 4 } }));
+    EXPECT_EQ(ideal_product({ { 1, 1 }, { 2 } }, { { 1, 2 }, { 3 } }),
+        (ideal_basis { { 1, 5 }, { 6 } }));
+}
+
+TEST(Ideal, Intersection)
+{
+    EXPECT_EQ(ideal_intersection({}, { { 2 } }), ideal_basis {});
+    EXPECT_EQ(ideal_intersection({ { 2 } }, { { 3 } }), (ideal_basis { { 6 } }));
+    EXPECT_EQ(ideal_intersection({ { 4 } }, { { 6 } }), (ideal_basis { { 12 } }));
+    EXPECT_EQ(ideal_intersection({ { 2 } }, { { 1, 0 } }), (ideal_basis { { 2, 0 } }));
+    EXPECT_EQ(ideal_intersection({ { 1, 0 } }, { { 1, 1 } }), (ideal_basis { { 1, 1, 0 } }));
+    EXPECT_EQ(ideal_intersection({ { 1, 0 }, { 2 } }, { { 1, 0 }, { 3 } }),
+        (ideal_basis { { 1, 0 }, { 6 } }));
+    EXPECT_EQ(ideal_intersection({ { 2 } }, { { 2, 1 } }), (ideal_basis { { 4, 2 } }));
+}
+
+TEST(Ideal, Colon)
+{
+    EXPECT_EQ(ideal_colon({}, 2), ideal_basis {});
+    EXPECT_EQ(ideal_colon({ { 2 } }, 0), (ideal_basis { { 1 } }));
+    EXPECT_EQ(ideal_colon({ { 6 } }, 2), (ideal_basis { { 3 } }));
+    EXPECT_EQ(ideal_colon({ { 6 } }, -4), (ideal_basis { { 3 } }));
+    EXPECT_EQ(ideal_colon({ { 2, 0 }, { 4 } }, 2), (ideal_basis { { 1, 0 }, { 2 } }));
+    EXPECT_EQ(ideal_colon({ { 1, 0, 1 }, { 3 } }, 3), (ideal_basis { { 1 } }));
+    EXPECT_EQ(ideal_colon({ { 1, 15 }, { 21 } }, 7), (ideal_basis { { 1, 0 }, { 3 } }));
+}
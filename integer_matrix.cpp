@@ -0,0 +1,61 @@
+#include "integer_matrix.h"
+#include "trace.h"
+
+std::size_t integer_matrix::hermite_normal_form()
+{
+    TRACE_SCOPE("hermite_normal_form");
+
+    // Rows are added to the normal form one at a time, and after each
+    // addition the entries above every pivot are reduced again.  Keeping
+    // the partial result reduced is what stops the coefficients from
+    // blowing up, which they do very quickly if whole columns are
+    // eliminated first and reduced only at the end.
+    struct pivot {
+        std::size_t row;
+        std::size_t col;
+    };
+    std::vector<pivot> pivots;
+
+    for (std::size_t i = 0; i < m_rows; ++i) {
+        const Z* v = row(i);
+        std::size_t col = 0;
+        auto p = pivots.begin();
+        for (;; ++col) {
+            while (col < m_cols && v[col] == 0)
+                ++col;
+            while (p != pivots.end() && p->col < col)
+                ++p;
+            if (col == m_cols || p == pivots.end() || p->col != col)
+                break;
+            combine_rows(p->row, i, col);
+        }
+        if (col < m_cols)
+            pivots.insert(p, pivot { i, col });
+
+        for (auto& q : pivots) {
+            Z* pr = row(q.row);
+            if (pr[q.col] < 0) {
+                for (std::size_t c = q.col; c < m_cols; ++c)
+                    pr[c] = -pr[c];
+            }
+        }
+        // Rows above a pivot are independent of each other here, and a
+        // later pivot only touches columns to the right of earlier ones,
+        // so a single pass in order leaves everything reduced.
+        for (std::size_t k = 1; k < pivots.size(); ++k) {
+            integer_matrix_details::parallel_for(k, m_cols - pivots[k].col, [&](std::size_t j) {
+                reduce_row(pivots[j].row, pivots[k].row, pivots[k].col);
+            });
+        }
+    }
+
+    // Gather the pivot rows at the top, in order.  Rows which never became
+    // a pivot were reduced to zero along the way.
+    for (std::size_t k = 0; k < pivots.size(); ++k) {
+        swap_rows(k, pivots[k].row);
+        for (std::size_t l = k + 1; l < pivots.size(); ++l)
+            if (pivots[l].row == k)
+                pivots[l].row = pivots[k].row;
+    }
+    return pivots.size();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "polynomial.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace integer_matrix_details {
+
+// Below this many coefficient updates, a batch of row operations is done
+// on the calling thread since starting threads would cost more than it saves.
+constexpr std::size_t parallel_threshold = 1 << 14;
+
+template <typename Fn>
+void parallel_for(std::size_t n, std::size_t work_per_item, Fn&& fn)
+{
+    std::size_t nthreads = std::max(1u, std::thread::hardware_concurrency());
+    nthreads = std::min(nthreads, n);
+    if (nthreads <= 1 || n * work_per_item < parallel_threshold) {
+        for (std::size_t i = 0; i < n; ++i)
+            fn(i);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(nthreads - 1);
+    auto run_chunk = [n, nthreads, &fn](std::size_t t) {
+        for (std::size_t i = n * t / nthreads; i < n * (t + 1) / nthreads; ++i)
+            fn(i);
+    };
+    for (std::size_t t = 1; t < nthreads; ++t)
+        threads.emplace_back(run_chunk, t);
+    run_chunk(0);
+    for (auto& th : threads)
+        th.join();
+}
+
+} // namespace integer_matrix_details
+
+// Dense integer matrix, stored row-major so that every row operation
+// streams through one contiguous block of memory.
+class integer_matrix {
+public:
+    integer_matrix(std::size_t rows, std::size_t cols)
+        : m_rows(rows)
+        , m_cols(cols)
+        , m_entries(rows * cols)
+    {
+    }
+
+    std::size_t rows() const { return m_rows; }
+    std::size_t cols() const { return m_cols; }
+    Z* row(std::size_t i) { return &m_entries[i * m_cols]; }
+    const Z* row(std::size_t i) const { return &m_entries[i * m_cols]; }
+
+    void swap_rows(std::size_t i, std::size_t j)
+    {
+        if (i != j)
+            std::swap_ranges(row(i), row(i) + m_cols, row(j));
+    }
+
+    // Replace the rows r and s by a unimodular combination such that
+    // r[col] becomes gcd(r[col], s[col]) and s[col] becomes 0.  Both rows
+    // must be zero to the left of col.
+    void combine_rows(std::size_t r, std::size_t s, std::size_t col)
+    {
+        Z* rr = row(r);
+        Z* sr = row(s);
+        Z g, u, v;
+        mpz_gcdext(g.get_mpz_t(), u.get_mpz_t(), v.get_mpz_t(),
+            rr[col].get_mpz_t(), sr[col].get_mpz_t());
+        Z a = rr[col] / g;
+        Z b = sr[col] / g;
+        Z new_r;
+        for (std::size_t c = col; c < m_cols; ++c) {
+            new_r = u * rr[c] + v * sr[c];
+            sr[c] = a * sr[c] - b * rr[c];
+            rr[c] = std::move(new_r);
+        }
+    }
+
+    // Subtract a multiple of the pivot row p from row r so that r[col]
+    // ends up in [0, p[col]).
+    void reduce_row(std::size_t r, std::size_t p, std::size_t col)
+    {
+        Z* rr = row(r);
+        const Z* pr = row(p);
+        Z q;
+        mpz_fdiv_q(q.get_mpz_t(), rr[col].get_mpz_t(), pr[col].get_mpz_t());
+        if (q == 0)
+            return;
+        for (std::size_t c = col; c < m_cols; ++c)
+            rr[c] -= q * pr[c];
+    }
+
+    // Bring the matrix into Hermite normal form, returning its rank; the
+    // nonzero rows are then 0 .. rank-1.
+    std::size_t hermite_normal_form();
+
+private:
+    std::size_t m_rows;
+    std::size_t m_cols;
+    std::vector<Z> m_entries;
+};
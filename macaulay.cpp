@@ -0,0 +1,79 @@
+#include "macaulay.h"
+#include "integer_matrix.h"
+#include <algorithm>
+#include <functional>
+
+void macaulay(ideal_basis& b, int degree_bound)
+{
+    b.erase(polynomial {});
+    if (b.empty())
+        return;
+
+    // By default go up to the size of the Sylvester matrix of the two
+    // generators of largest degree; at that point the shifts of those two
+    // alone already span everything of degree up to the bound which their
+    // resultant can reach.
+    int max_degree = b.begin()->degree();
+    if (degree_bound < 0)
+        degree_bound = std::next(b.begin()) == b.end()
+            ? max_degree
+            : max_degree + std::next(b.begin())->degree() - 1;
+    degree_bound = std::max(degree_bound, max_degree);
+    std::size_t nrows = 0;
+    for (const auto& g : b)
+        nrows += degree_bound - g.degree() + 1;
+
+    // Column c holds the coefficient of x^(degree_bound - c).
+    integer_matrix m(nrows, degree_bound + 1);
+    std::size_t r = 0;
+    for (const auto& g : b) {
+        for (int k = 0; k <= degree_bound - g.degree(); ++k, ++r) {
+            Z* row = m.row(r);
+            for (int d = 0; d <= g.degree(); ++d)
+                row[degree_bound - k - d] = g.coefficient(d);
+        }
+    }
+
+    std::size_t rank = m.hermite_normal_form();
+
+    // Every row is an integer combination of the generators and every
+    // generator is one of the original rows, so the rows generate the same
+    // ideal.  They need not be a Groebner basis if the degree bound was too
+    // small to see some cancellation, so buchberger() finishes the job.
+    b.clear();
+    for (std::size_t i = 0; i < rank; ++i)
+        b.insert(polynomial { std::vector<Z>(m.row(i), m.row(i) + m.cols()) });
+    buchberger(b);
+}
+
+groebner_engine choose_engine(const ideal_basis& b)
+{
+    // From timing both engines on random generators with coefficients in
+    // [-10, 10]: once the two largest degrees add up to 20 or so the matrix
+    // engine wins by one to three orders of magnitude, while below that
+    // both take milliseconds and buchberger() is usually ahead.  With more
+    // than three generators, a generator of small degree lets buchberger()
+    // shrink everything else quickly, and it wins again.
+    std::vector<int> degrees;
+    for (const auto& g : b)
+        if (g.degree() >= 0)
+            degrees.push_back(g.degree());
+    if (degrees.size() < 2)
+        return groebner_engine::buchberger;
+    std::sort(degrees.begin(), degrees.end(), std::greater<int>());
+    if (degrees[0] + degrees[1] < 20)
+        return groebner_engine::buchberger;
+    if (degrees.size() > 3 && 2 * degrees.back() < degrees[0])
+        return groebner_engine::buchberger;
+    return groebner_engine::macaulay;
+}
+
+void groebner_basis(ideal_basis& b, groebner_engine engine)
+{
+    if (engine == groebner_engine::automatic)
+        engine = choose_engine(b);
+    if (engine == groebner_engine::macaulay)
+        macaulay(b);
+    else
+        buchberger(b);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "buchberger.h"
+
+// Alternative to buchberger() which first places every shift
+// x^k * g, deg(x^k * g) <= degree_bound, of the generators into a
+// coefficient matrix and brings it into Hermite normal form.  The rows of
+// the normal form are already close to a Groebner basis, so the final
+// pass through buchberger() which completes and reduces them is cheap.
+//
+// A negative degree_bound (the default) means the sum of the two largest
+// generator degrees minus one; bounds below the largest generator degree
+// are raised to that value.
+void macaulay(ideal_basis& b, int degree_bound = -1);
+
+enum class groebner_engine {
+    automatic,
+    buchberger,
+    macaulay,
+};
+
+// Heuristic choice between the two engines for the given generators;
+// never returns groebner_engine::automatic.
+groebner_engine choose_engine(const ideal_basis& b);
+
+void groebner_basis(ideal_basis& b, groebner_engine engine = groebner_engine::automatic);
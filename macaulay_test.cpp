@@ -0,0 +1,69 @@
+#include "macaulay.h"
+#include <gtest/gtest.h>
+
+ideal_basis macaulay_of(const ideal_basis& b, int degree_bound = -1)
+{
+    ideal_basis result = b;
+    macaulay(result, degree_bound);
+    return result;
+}
+
+TEST(Macaulay, Macaulay)
+{
+    EXPECT_EQ(macaulay_of({}), ideal_basis {});
+    EXPECT_EQ(macaulay_of({ {} }), ideal_basis {});
+    EXPECT_EQ(macaulay_of({ { 1, 3, 2 } }), (ideal_basis { { 1, 3, 2 } }));
+    EXPECT_EQ(macaulay_of({ { -1, -3, -2 } }), (ideal_basis { { 1, 3, 2 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 3, 2 }, { 4, 4 } }),
+        (ideal_basis { { 1, 3, 2 }, { 4, 4 } }));
+    EXPECT_EQ(macaulay_of({ { 1, -3, 2 }, { 4, -4 } }),
+        (ideal_basis { { 1, 1, -2 }, { 4, -4 } }));
+    EXPECT_EQ(macaulay_of({ { 16 }, { 10 } }),
+        (ideal_basis { { 2 } }));
+    EXPECT_EQ(macaulay_of({ { 10, -20 }, { 16 } }),
+        (ideal_basis { { 2, 12 }, { 16 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 16 }, { 1, 10 } }),
+        (ideal_basis { { 1, 4 }, { 6 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 1, 0 }, { 4, -3 } }),
+        (ideal_basis { { 1, 15 }, { 21 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 1, 0 }, { 4, -4 } }),
+        (ideal_basis { { 1, 1, 0 }, { 4, 4 }, { 8 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 0, 1 }, { 3, 2 } }),
+        (ideal_basis { { 1, 5 }, { 13 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 0, 5 }, { 1, -1 }, { 2 } }),
+        (ideal_basis { { 1, 1 }, { 2 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 0, 5 }, { 1, -1 }, { 3 } }),
+        (ideal_basis { { 1, 2 }, { 3 } }));
+
+    // The degree bound only affects how much work is left for the final
+    // buchberger() pass, not the result.
+    EXPECT_EQ(macaulay_of({ { 1, 1, 0 }, { 4, -3 } }, 0),
+        (ideal_basis { { 1, 15 }, { 21 } }));
+    EXPECT_EQ(macaulay_of({ { 1, 1, 0 }, { 4, -3 } }, 10),
+        (ideal_basis { { 1, 15 }, { 21 } }));
+
+    // This one is only practical for buchberger() with RUN_EXPENSIVE_TESTS,
+    // but is quick here.
+    EXPECT_EQ(macaulay_of({ { 1, 0, 0, 5, 3, 0, 0, 0, 0, 0, 9, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0 },
+                  { 3, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 1 } }),
+        (ideal_basis { { 1, 7747110435841547256507133_Z },
+            { 11529190147322608601758016_Z } }));
+}
+
+TEST(Macaulay, ChooseEngine)
+{
+    EXPECT_EQ(choose_engine({}), groebner_engine::buchberger);
+    EXPECT_EQ(choose_engine({ { 1, 3, 2 }, { 4, 4 } }), groebner_engine::buchberger);
+    EXPECT_EQ(choose_engine({ polynomial(std::vector<Z>(17, 1)), polynomial(std::vector<Z>(12, 2)) }),
+        groebner_engine::macaulay);
+}
+
+TEST(Macaulay, GroebnerBasis)
+{
+    for (auto engine : { groebner_engine::automatic, groebner_engine::buchberger,
+             groebner_engine::macaulay }) {
+        ideal_basis b { { 1, 0, 5 }, { 1, -1 }, { 2 } };
+        groebner_basis(b, engine);
+        EXPECT_EQ(b, (ideal_basis { { 1, 1 }, { 2 } }));
+    }
+}
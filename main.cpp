@@ -1,22 +1,18 @@
 #include "buchberger.h"
+#include "macaulay.h"
 #include "polynomial.h"
+#include "trace.h"
+#include "verify.h"
+#include <fstream>
 #include <iostream>
 #include <iterator>
 #include <sstream>
+#include <stdexcept>
 #include <unistd.h>
 
-int main()
+std::vector<polynomial> read_polynomials()
 {
-    if (isatty(STDIN_FILENO)) {
-        std::cout << "groebner-zx  Copyright (C) 2020  Daniel Schepler\n";
-        std::cout << "This program comes with ABSOLUTELY NO WARRANTY.\n";
-        std::cout << "This is free software, and you are welcome to redistribute it\n";
-        std::cout << "under the conditions of the GNU General Public License v3\n\n";
-        std::cout << "Enter the list of polynomials, one on each line as a list of coefficients\n";
-        std::cout << "e.g. enter x^5 - 3x^2 + x as: 1 0 0 -3 1 0\n";
-        std::cout << "Then end the list with a blank line or EOF\n";
-    }
-
+    TRACE_SCOPE("parse");
     std::string line;
     std::vector<polynomial> v;
     while (std::getline(std::cin, line) && !line.empty()) {
@@ -25,27 +21,141 @@ int main()
             std::istream_iterator<Z> {} } };
         v.push_back(std::move(p));
     }
+    return v;
+}
 
+template <typename Container>
+void print_ideal(const Container& c)
+{
+    TRACE_SCOPE("print");
     std::cout << "< ";
     bool first = true;
-    for (const auto& p : v) {
+    for (const auto& p : c) {
         if (!first)
             std::cout << ", ";
         std::cout << p.to_string();
         first = false;
     }
-    std::cout << " > = " << std::flush;
+    std::cout << " >";
+}
 
-    ideal_basis b { v.begin(), v.end() };
-    buchberger(b);
-    std::cout << "< ";
-    first = true;
-    for (const auto& p : b) {
-        if (!first)
-            std::cout << ", ";
-        std::cout << p.to_string();
-        first = false;
+int usage(const char* program)
+{
+    std::cerr << "Usage: " << program << " [--engine=auto|buchberger|macaulay]\n";
+    std::cerr << "       " << program << " --verify [--exact] [--rounds=N]\n";
+#ifdef GROEBNER_TRACING
+    std::cerr << "Either form also accepts --trace=FILE\n";
+#endif
+    return 1;
+}
+
+// Parse s, which must consist of decimal digits only, into n > 0; on
+// failure n is left alone.
+bool parse_positive(const std::string& s, int& n)
+{
+    if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos)
+        return false;
+    int value;
+    try {
+        value = std::stoi(s);
+    } catch (const std::out_of_range&) {
+        return false;
+    }
+    if (value <= 0)
+        return false;
+    n = value;
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    groebner_engine engine = groebner_engine::automatic;
+    bool verify = false;
+    verify_options options;
+    std::string trace_file;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--engine=auto")
+            engine = groebner_engine::automatic;
+        else if (arg == "--engine=buchberger")
+            engine = groebner_engine::buchberger;
+        else if (arg == "--engine=macaulay")
+            engine = groebner_engine::macaulay;
+        else if (arg == "--verify")
+            verify = true;
+        else if (arg == "--exact")
+            options.exact = true;
+        else if (arg.compare(0, 9, "--rounds=") == 0) {
+            if (!parse_positive(arg.substr(9), options.rounds))
+                return usage(argv[0]);
+        }
+#ifdef GROEBNER_TRACING
+        else if (arg.compare(0, 8, "--trace=") == 0)
+            trace_file = arg.substr(8);
+#endif
+        else
+            return usage(argv[0]);
+    }
+
+#ifdef GROEBNER_TRACING
+    // Open the trace file up front, so that a bad name is reported before
+    // any work is done.
+    std::ofstream trace_os;
+    if (!trace_file.empty()) {
+        trace_os.open(trace_file);
+        if (!trace_os) {
+            std::cerr << argv[0] << ": cannot open " << trace_file << " for writing\n";
+            return 1;
+        }
+        trace::start();
+    }
+#endif
+
+    if (isatty(STDIN_FILENO)) {
+        std::cout << "groebner-zx  Copyright (C) 2020  Daniel Schepler\n";
+        std::cout << "This program comes with ABSOLUTELY NO WARRANTY.\n";
+        std::cout << "This is free software, and you are welcome to redistribute it\n";
+        std::cout << "under the conditions of the GNU General Public License v3\n\n";
+        std::cout << "Enter the list of polynomials, one on each line as a list of coefficients\n";
+        std::cout << "e.g. enter x^5 - 3x^2 + x as: 1 0 0 -3 1 0\n";
+        std::cout << "Then end the list with a blank line or EOF\n";
+        if (verify)
+            std::cout << "Then enter the claimed basis in the same way\n";
+    }
+
+    std::vector<polynomial> v = read_polynomials();
+
+    int status = 0;
+    if (verify) {
+        std::vector<polynomial> w = read_polynomials();
+        print_ideal(v);
+        std::cout << " = ";
+        print_ideal(w);
+        std::cout << " ? " << std::flush;
+        bool ok = verify_basis(ideal_basis { v.begin(), v.end() },
+            ideal_basis { w.begin(), w.end() }, options);
+        std::cout << (ok ? "yes\n" : "no\n");
+        status = ok ? 0 : 1;
+    } else {
+        print_ideal(v);
+        std::cout << " = " << std::flush;
+
+        ideal_basis b { v.begin(), v.end() };
+        groebner_basis(b, engine);
+        print_ideal(b);
+        std::cout << "\n";
+    }
+
+#ifdef GROEBNER_TRACING
+    if (trace_os.is_open()) {
+        trace::stop();
+        trace::write_chrome_trace(trace_os);
+        trace_os.close();
+        if (!trace_os) {
+            std::cerr << argv[0] << ": error writing " << trace_file << "\n";
+            status = 1;
+        }
     }
-    std::cout << " >\n";
-    return 0;
+#endif
+    return status;
 }
@@ -1,4 +1,5 @@
 #include "polynomial.h"
+#include "trace.h"
 #include <algorithm>
 
 polynomial::polynomial(std::initializer_list<Z> coeffs)
@@ -26,6 +27,32 @@ void polynomial::negate()
         coeff = -coeff;
 }
 
+Z polynomial::content() const
+{
+    Z result = 0;
+    for (const auto& coeff : m_coeffs) {
+        mpz_gcd(result.get_mpz_t(), result.get_mpz_t(), coeff.get_mpz_t());
+        if (result == 1)
+            break;
+    }
+    return result;
+}
+
+polynomial polynomial::primitive_part() const
+{
+    polynomial result = *this;
+    Z c = content();
+    if (c > 1)
+        result.divide_exact(c);
+    return result;
+}
+
+void polynomial::divide_exact(const Z& n)
+{
+    for (auto& coeff : m_coeffs)
+        mpz_divexact(coeff.get_mpz_t(), coeff.get_mpz_t(), n.get_mpz_t());
+}
+
 polynomial& polynomial::operator*=(Z n)
 {
     if (n == 0)
@@ -84,6 +111,9 @@ polynomial operator*(const polynomial& p, const polynomial& q)
     if (q.degree() == 0)
         return p * q.coefficient(0);
 
+    TRACE_SCOPE_IF(std::max(p.degree(), q.degree()) >= trace::multiply_min_degree,
+        "polynomial multiply");
+
     // In the following, we'll be using each coefficient of p and q
     // multiple times, which is why we have designed the interface to let
     // the caller materialize p and q for us.
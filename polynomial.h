@@ -206,6 +206,15 @@ public:
 
     void negate();
 
+    // The content is the (nonnegative) gcd of the coefficients, with the
+    // content of 0 being 0; the primitive part is the polynomial divided by
+    // its content, so that p == p.content() * p.primitive_part().
+    Z content() const;
+    polynomial primitive_part() const;
+
+    // Divide every coefficient by n, which must divide all of them exactly.
+    void divide_exact(const Z& n);
+
     template <typename PolyExpr,
         typename = typename std::decay_t<PolyExpr>::is_polynomial_expr>
     polynomial& operator+=(PolyExpr&& p)
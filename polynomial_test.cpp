@@ -40,6 +40,26 @@ TEST(Polynomial, Negate)
     EXPECT_EQ((-polynomial { 1, -3, -2 }), (polynomial { -1, 3, 2 }));
 }
 
+TEST(Polynomial, Content)
+{
+    EXPECT_EQ((polynomial {}.content()), 0);
+    EXPECT_EQ((polynomial { 5 }.content()), 5);
+    EXPECT_EQ((polynomial { -5 }.content()), 5);
+    EXPECT_EQ((polynomial { 4, 0, -6 }.content()), 2);
+    EXPECT_EQ((polynomial { 1, 2, 3 }.content()), 1);
+    EXPECT_EQ((polynomial { 12, 18, 30 }.content()), 6);
+}
+
+TEST(Polynomial, PrimitivePart)
+{
+    EXPECT_EQ((polynomial {}.primitive_part()), (polynomial {}));
+    EXPECT_EQ((polynomial { 5 }.primitive_part()), (polynomial { 1 }));
+    EXPECT_EQ((polynomial { -5 }.primitive_part()), (polynomial { -1 }));
+    EXPECT_EQ((polynomial { 4, 0, -6 }.primitive_part()), (polynomial { 2, 0, -3 }));
+    EXPECT_EQ((polynomial { -12, 18, 30 }.primitive_part()), (polynomial { -2, 3, 5 }));
+    EXPECT_EQ((polynomial { 1, 2, 3 }.primitive_part()), (polynomial { 1, 2, 3 }));
+}
+
 TEST(Polynomial, TimesXTo)
 {
     EXPECT_EQ(times_x_to(polynomial {}, 5), (polynomial {}));
@@ -0,0 +1,158 @@
+#include "trace.h"
+
+#ifdef GROEBNER_TRACING
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace trace {
+
+std::atomic<bool> enabled { false };
+
+namespace details {
+
+struct event {
+    const char* name;
+    std::uint64_t start_ns;
+    std::uint64_t end_ns;
+};
+
+// Only the owning thread writes to a buffer; count is published with
+// release ordering so that write_chrome_trace() sees complete events.
+// The events grow as needed, up to events_per_thread.
+struct thread_buffer {
+    explicit thread_buffer(int tid)
+        : tid(tid)
+    {
+    }
+
+    int tid;
+    std::vector<event> events;
+    std::atomic<std::size_t> count { 0 };
+};
+
+// Buffers are owned here rather than by the threads, so that events from
+// short-lived worker threads survive until they are written out.  When a
+// thread exits, its buffer goes on the free list and the next new thread
+// carries on in it, so there are only ever as many buffers as threads
+// running at once.
+struct registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<thread_buffer>> buffers;
+    std::vector<thread_buffer*> free;
+};
+
+registry& global_registry()
+{
+    static registry r;
+    return r;
+}
+
+struct buffer_lease {
+    ~buffer_lease()
+    {
+        if (buffer) {
+            registry& r = global_registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.free.push_back(buffer);
+        }
+    }
+
+    thread_buffer* buffer = nullptr;
+};
+
+thread_buffer& local_buffer()
+{
+    thread_local buffer_lease lease;
+    if (!lease.buffer) {
+        registry& r = global_registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        if (!r.free.empty()) {
+            lease.buffer = r.free.back();
+            r.free.pop_back();
+        } else {
+            r.buffers.push_back(std::make_unique<thread_buffer>(r.buffers.size() + 1));
+            lease.buffer = r.buffers.back().get();
+        }
+    }
+    return *lease.buffer;
+}
+
+// Chrome traces use microseconds; keep the nanoseconds as decimals.
+void write_us(std::ostream& os, std::uint64_t ns)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof buf, "%llu.%03llu",
+        static_cast<unsigned long long>(ns / 1000),
+        static_cast<unsigned long long>(ns % 1000));
+    os << buf;
+}
+
+} // namespace details
+
+void start()
+{
+    now_ns();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+void stop()
+{
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+std::uint64_t now_ns()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - epoch)
+        .count();
+}
+
+void record(const char* name, std::uint64_t start_ns, std::uint64_t end_ns)
+{
+    details::thread_buffer& buffer = details::local_buffer();
+    std::size_t n = buffer.count.load(std::memory_order_relaxed);
+    details::event e { name, start_ns, end_ns };
+    if (n < events_per_thread)
+        buffer.events.push_back(e);
+    else
+        buffer.events[n % events_per_thread] = e;
+    buffer.count.store(n + 1, std::memory_order_release);
+}
+
+void write_chrome_trace(std::ostream& os)
+{
+    details::registry& r = details::global_registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : r.buffers) {
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid
+           << ",\"args\":{\"name\":\"thread " << buffer->tid << "\"}}";
+
+        std::size_t n = buffer->count.load(std::memory_order_acquire);
+        std::size_t k = n > events_per_thread ? n - events_per_thread : 0;
+        for (; k < n; ++k) {
+            const details::event& e = buffer->events[k % events_per_thread];
+            os << ",\n{\"name\":\"" << e.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+               << buffer->tid << ",\"ts\":";
+            details::write_us(os, e.start_ns);
+            os << ",\"dur\":";
+            details::write_us(os, e.end_ns - e.start_ns);
+            os << "}";
+        }
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+} // namespace trace
+
+#endif // GROEBNER_TRACING
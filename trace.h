@@ -0,0 +1,84 @@
+#pragma once
+
+// Optional timeline tracing, written out in the Chrome trace event format
+// (load the file in chrome://tracing or https://ui.perfetto.dev).
+//
+// Tracing is compiled in only when GROEBNER_TRACING is defined (meson
+// option -Dtracing=true).  Otherwise TRACE_SCOPE and TRACE_SCOPE_IF expand
+// to nothing, without even evaluating their arguments.  When compiled in,
+// nothing is recorded until trace::start() is called.
+//
+//   TRACE_SCOPE("name");
+//     records an event from here to the end of the enclosing scope
+//   TRACE_SCOPE_IF(condition, "name");
+//     the same, but only if condition holds
+//
+// Names must be string literals (or otherwise live for the whole program).
+
+#ifdef GROEBNER_TRACING
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace trace {
+
+// Size thresholds above which the corresponding calls are traced.
+constexpr int reduce_mod_min_steps = 16;
+constexpr int multiply_min_degree = 64;
+
+// Each thread records into its own ring buffer of up to this many events;
+// once it is full, the oldest events are overwritten.  A thread which
+// starts after another has exited reuses that thread's buffer (and its
+// tid in the output).
+constexpr std::size_t events_per_thread = 1 << 16;
+
+extern std::atomic<bool> enabled;
+
+void start();
+void stop();
+
+// Write everything recorded so far.  Must not run concurrently with
+// traced code on other threads.
+void write_chrome_trace(std::ostream& os);
+
+std::uint64_t now_ns();
+void record(const char* name, std::uint64_t start_ns, std::uint64_t end_ns);
+
+class scope {
+public:
+    explicit scope(const char* name, bool condition = true)
+        : m_name(condition && enabled.load(std::memory_order_relaxed) ? name : nullptr)
+        , m_start_ns(m_name ? now_ns() : 0)
+    {
+    }
+    ~scope()
+    {
+        if (m_name)
+            record(m_name, m_start_ns, now_ns());
+    }
+
+    scope(const scope&) = delete;
+    scope& operator=(const scope&) = delete;
+
+private:
+    const char* m_name;
+    std::uint64_t m_start_ns;
+};
+
+} // namespace trace
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+#define TRACE_SCOPE(name) \
+    trace::scope TRACE_CONCAT(trace_scope_, __LINE__) { name }
+#define TRACE_SCOPE_IF(condition, name) \
+    trace::scope TRACE_CONCAT(trace_scope_, __LINE__) { name, condition }
+
+#else // GROEBNER_TRACING
+
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_SCOPE_IF(condition, name) ((void)0)
+
+#endif // GROEBNER_TRACING
@@ -0,0 +1,64 @@
+#include "buchberger.h"
+#include "trace.h"
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+#ifdef GROEBNER_TRACING
+
+TEST(Trace, ChromeTrace)
+{
+    ideal_basis b { { 1, 1, 0 }, { 4, -3 } };
+    trace::start();
+    buchberger(b);
+    trace::stop();
+    ideal_basis c { { 1, 0, 1 }, { 3, 2 } };
+    buchberger(c);
+    {
+        TRACE_SCOPE("not recorded");
+    }
+
+    std::ostringstream os;
+    trace::write_chrome_trace(os);
+    std::string json = os.str();
+    EXPECT_EQ(json.rfind("{\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"buchberger_search\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_EQ(json.find("not recorded"), std::string::npos);
+    // Reductions of such small polynomials are below the threshold
+    EXPECT_EQ(json.find("reduce_mod"), std::string::npos);
+}
+
+TEST(Trace, ReuseBuffers)
+{
+    auto thread_count = [] {
+        std::ostringstream os;
+        trace::write_chrome_trace(os);
+        std::string json = os.str();
+        int count = 0;
+        for (auto i = json.find("thread_name"); i != std::string::npos; i = json.find("thread_name", i + 1))
+            ++count;
+        return count;
+    };
+
+    int before = thread_count();
+    trace::start();
+    for (int i = 0; i < 8; ++i) {
+        std::thread t([] { TRACE_SCOPE("worker"); });
+        t.join();
+    }
+    trace::stop();
+    // Each thread has exited before the next starts, so they all share
+    // one buffer, which may even be left over from an earlier test.
+    EXPECT_LE(thread_count(), before + 1);
+}
+
+#else // GROEBNER_TRACING
+
+TEST(Trace, CompiledOut)
+{
+    int evaluated = 0;
+    TRACE_SCOPE_IF(++evaluated > 0, "name");
+    EXPECT_EQ(evaluated, 0);
+}
+
+#endif // GROEBNER_TRACING
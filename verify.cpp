@@ -0,0 +1,374 @@
+#include "verify.h"
+#include "macaulay.h"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+namespace verify_details {
+
+// Polynomials over F_p for word-size primes p around 2^30, so that a
+// product of two residues plus a third still fits in 64 bits.
+// Coefficients are stored lowest degree first, with no trailing zeros.
+using word = std::uint64_t;
+using poly_mod_p = std::vector<word>;
+
+void trim(poly_mod_p& a)
+{
+    while (!a.empty() && a.back() == 0)
+        a.pop_back();
+}
+
+poly_mod_p reduce(const polynomial& f, word p)
+{
+    poly_mod_p result(f.degree() + 1);
+    for (int d = 0; d <= f.degree(); ++d)
+        result[d] = mpz_fdiv_ui(f.coefficient(d).get_mpz_t(), p);
+    trim(result);
+    return result;
+}
+
+word power(word a, word e, word p)
+{
+    word result = 1;
+    for (; e > 0; e >>= 1) {
+        if (e & 1)
+            result = result * a % p;
+        a = a * a % p;
+    }
+    return result;
+}
+
+word inverse(word a, word p)
+{
+    return power(a, p - 2, p);
+}
+
+// Replace a by its remainder modulo b, which must be nonzero.
+void remainder(poly_mod_p& a, const poly_mod_p& b, word p)
+{
+    word lead_inv = inverse(b.back(), p);
+    while (a.size() >= b.size()) {
+        word q = a.back() * lead_inv % p;
+        std::size_t shift = a.size() - b.size();
+        for (std::size_t i = 0; i < b.size(); ++i)
+            a[shift + i] = (a[shift + i] + (p - q) * b[i]) % p;
+        trim(a);
+    }
+}
+
+// Monic generator of the ideal of F_p[x] spanned by the images of the
+// given polynomials.
+poly_mod_p ideal_image(const ideal_basis& b, word p)
+{
+    poly_mod_p g;
+    for (const auto& f : b) {
+        poly_mod_p a = reduce(f, p);
+        while (!a.empty()) {
+            remainder(g, a, p);
+            std::swap(g, a);
+        }
+    }
+    if (!g.empty()) {
+        word lead_inv = inverse(g.back(), p);
+        for (auto& coeff : g)
+            coeff = coeff * lead_inv % p;
+    }
+    return g;
+}
+
+// Resultant of a and b, both nonzero, via Res(a, b) =
+// (-1)^(deg a deg b) lc(b)^(deg a - deg r) Res(b, r) for r = a mod b.
+word resultant(poly_mod_p a, poly_mod_p b, word p)
+{
+    word result = 1;
+    while (b.size() > 1) {
+        std::size_t deg_a = a.size() - 1;
+        std::size_t deg_b = b.size() - 1;
+        remainder(a, b, p);
+        if (a.empty())
+            return 0;
+        result = result * power(b.back(), deg_a - (a.size() - 1), p) % p;
+        if (deg_a % 2 != 0 && deg_b % 2 != 0)
+            result = (p - result) % p;
+        std::swap(a, b);
+    }
+    return result * power(b.front(), a.size() - 1, p) % p;
+}
+
+class prime_source {
+public:
+    explicit prime_source(std::mt19937& rng)
+        : m_rng(rng)
+    {
+    }
+
+    // A prime in [2^30, 2^31) not returned before.
+    word next()
+    {
+        std::uniform_int_distribution<word> dist(word(1) << 30, (word(1) << 31) - 1);
+        while (true) {
+            Z candidate = Z(static_cast<unsigned long>(dist(m_rng)));
+            mpz_nextprime(candidate.get_mpz_t(), candidate.get_mpz_t());
+            word p = candidate.get_ui();
+            if (m_used.insert(p).second)
+                return p;
+        }
+    }
+
+private:
+    std::mt19937& m_rng;
+    std::set<word> m_used;
+};
+
+// Whether the basis fs (in basis order) is in the form buchberger() leaves
+// it in: positive leading coefficients, nothing reducible by a later
+// element, and every raised lower element reducing to 0 by the elements
+// from the degree it was raised to, so that fs is a Groebner basis.  This
+// only ever reduces elements of fs by each other, so the coefficients stay
+// of the size of those already in fs.
+bool is_reduced_basis(const std::vector<polynomial>& fs)
+{
+    for (std::size_t i = 0; i < fs.size(); ++i) {
+        if (fs[i].leading_coefficient() <= 0)
+            return false;
+        polynomial p = fs[i];
+        for (std::size_t j = i + 1; j < fs.size(); ++j)
+            reduce_mod(p, fs[j]);
+        if (p != fs[i])
+            return false;
+    }
+    for (std::size_t i = 0; i < fs.size(); ++i) {
+        for (std::size_t j = i + 1; j < fs.size(); ++j) {
+            polynomial p = times_x_to(fs[j], fs[i].degree() - fs[j].degree());
+            for (std::size_t k = i; k < fs.size(); ++k)
+                reduce_mod(p, fs[k]);
+            if (p != polynomial {})
+                return false;
+        }
+    }
+    return true;
+}
+
+// Whether p lies in the ideal generated by the reduced Groebner basis fs.
+// This reduces the coefficient of each x^e in turn, from the top, by the
+// element of largest degree at most e, which gives the same remainder as
+// reducing by every element in order; since the remainder is unique, p is
+// in the ideal exactly when every coefficient reduces to 0.  If fs ends
+// with a constant n, all coefficients are also kept in [0, n).
+bool in_ideal(const polynomial& p, const std::vector<polynomial>& fs)
+{
+    const Z n = fs.back().degree() == 0 ? fs.back().coefficient(0) : Z(0);
+    std::vector<Z> coeffs(p.degree() + 1);
+    for (int d = 0; d <= p.degree(); ++d) {
+        coeffs[d] = p.coefficient(d);
+        if (n != 0)
+            mpz_fdiv_r(coeffs[d].get_mpz_t(), coeffs[d].get_mpz_t(), n.get_mpz_t());
+    }
+
+    std::size_t k = 0;
+    Z q;
+    for (int e = p.degree(); e >= 0; --e) {
+        while (k < fs.size() && fs[k].degree() > e)
+            ++k;
+        if (k == fs.size())
+            return std::all_of(coeffs.begin(), coeffs.begin() + e + 1,
+                [](const Z& c) { return c == 0; });
+        const polynomial& f = fs[k];
+        int shift = e - f.degree();
+        mpz_fdiv_q(q.get_mpz_t(), coeffs[e].get_mpz_t(), f.leading_coefficient().get_mpz_t());
+        if (q != 0) {
+            for (int d = 0; d <= f.degree(); ++d) {
+                Z& c = coeffs[shift + d];
+                c -= q * f.coefficient(d);
+                if (n != 0)
+                    mpz_fdiv_r(c.get_mpz_t(), c.get_mpz_t(), n.get_mpz_t());
+            }
+        }
+        if (coeffs[e] != 0)
+            return false;
+    }
+    return true;
+}
+
+Z sum_of_squares(const polynomial& f)
+{
+    Z result = 0;
+    for (int d = 0; d <= f.degree(); ++d)
+        result += f.coefficient(d) * f.coefficient(d);
+    return result;
+}
+
+// Res(f, g) over Z by Chinese remaindering.  Without early termination this
+// runs until the product of the primes exceeds twice the Hadamard bound
+// ||f||^deg(g) ||g||^deg(f); with it, it also stops once the symmetric
+// lift has not changed for `rounds` primes in a row.
+Z resultant(const polynomial& f, const polynomial& g, prime_source& primes,
+    bool early_termination, int rounds)
+{
+    Z bound_squared = 4;
+    Z t;
+    mpz_pow_ui(t.get_mpz_t(), sum_of_squares(f).get_mpz_t(), g.degree());
+    bound_squared *= t;
+    mpz_pow_ui(t.get_mpz_t(), sum_of_squares(g).get_mpz_t(), f.degree());
+    bound_squared *= t;
+
+    Z residue = 0;
+    Z modulus = 1;
+    Z lift = 0;
+    int unchanged = 0;
+    while (modulus * modulus <= bound_squared) {
+        word p = primes.next();
+        poly_mod_p a = reduce(f, p);
+        poly_mod_p b = reduce(g, p);
+        if (a.size() != static_cast<std::size_t>(f.degree() + 1)
+            || b.size() != static_cast<std::size_t>(g.degree() + 1))
+            continue;
+        word r = resultant(std::move(a), std::move(b), p);
+
+        word k = (r + p - mpz_fdiv_ui(residue.get_mpz_t(), p)) % p
+            * inverse(mpz_fdiv_ui(modulus.get_mpz_t(), p), p) % p;
+        residue += modulus * static_cast<unsigned long>(k);
+        modulus *= static_cast<unsigned long>(p);
+
+        Z new_lift = 2 * residue > modulus ? Z(residue - modulus) : residue;
+        unchanged = new_lift == lift ? unchanged + 1 : 0;
+        lift = std::move(new_lift);
+        if (early_termination && unchanged >= rounds)
+            break;
+    }
+    return lift;
+}
+
+// Index in Z^(D+1) of the polynomials of degree at most D in the ideal
+// generated by the reduced Groebner basis fs: the product, over each
+// degree e <= D, of the leading coefficient of the element of largest
+// degree at most e.  This is 0 if fs contains no constant.
+Z lattice_index(const std::vector<polynomial>& fs, int degree_bound)
+{
+    if (fs.back().degree() != 0)
+        return 0;
+    Z result = 1;
+    std::size_t k = fs.size() - 1;
+    for (int e = 0; e <= degree_bound; ++e) {
+        while (k > 0 && fs[k - 1].degree() <= e)
+            --k;
+        result *= fs[k].leading_coefficient();
+    }
+    return result;
+}
+
+// The largest divisor of m (nonzero) all of whose prime factors divide g.
+Z smooth_part(Z m, const Z& g)
+{
+    Z result = 1;
+    for (Z c = gcd(m, g); c > 1; c = gcd(m, g)) {
+        m /= c;
+        result *= c;
+    }
+    return result;
+}
+
+// Try to prove that the ideal generated by the reduced Groebner basis fs
+// lies in the ideal I generated by gens, given that gens lie in the ideal
+// of fs; false means no conclusion either way.
+//
+// Take f, the first generator, and g, a random combination of the others,
+// and set D = deg f + deg g - 1.  The shifts
+// x^k f (k < deg g) and x^k g (k < deg f) of the Sylvester matrix span a
+// lattice L in I of index R = |Res(f, g)| in Z^(D+1), while the part of
+// degree at most D of the ideal of fs, which contains L, has the index T
+// from lattice_index().  At each prime q not dividing R / T, the two
+// lattices therefore agree after inverting the integers prime to q, so
+// every element of fs lies in I localized at q.  Extra factors in R / T
+// come from cancellation beyond degree D, which needs both leading
+// coefficients to vanish mod q; any other factor gives no conclusion.  For
+// the primes dividing both, let w be the part of R made up of them.  I
+// contains R, so it agrees with I + <w> at each of them, which is checked
+// by buchberger() on the generators plus w, where every coefficient stays
+// below w.  Finally, an ideal which contains an element locally at every
+// prime contains it.
+bool basis_in_ideal(const ideal_basis& gens, const std::vector<polynomial>& fs,
+    prime_source& primes, std::mt19937& rng, const verify_options& options)
+{
+    if (gens.size() < 2 || gens.rbegin()->degree() == 0 || fs.back().degree() != 0)
+        return false;
+    std::uniform_int_distribution<int> dist(1, 1 << 16);
+    const polynomial& f = *gens.begin();
+    // The first coefficient is 1 so that g has no needless common factor
+    // for R to pick up.
+    polynomial g = *std::next(gens.begin());
+    for (auto i = std::next(gens.begin(), 2); i != gens.end(); ++i)
+        g += Z(dist(rng)) * *i;
+    if (g.degree() <= 0)
+        return false;
+    int degree_bound = f.degree() + g.degree() - 1;
+    if (fs.front().degree() > degree_bound)
+        return false;
+
+    Z r = abs(resultant(f, g, primes, !options.exact, options.rounds));
+    Z t = lattice_index(fs, degree_bound);
+    if (r == 0 || r % t != 0)
+        return false;
+    Z lc_gcd = gcd(f.leading_coefficient(), g.leading_coefficient());
+    if (smooth_part(r / t, lc_gcd) != r / t)
+        return false;
+    Z w = smooth_part(r, lc_gcd);
+    if (w == 1)
+        return true;
+
+    ideal_basis lhs = gens;
+    lhs.insert(polynomial { w });
+    buchberger(lhs);
+    ideal_basis rhs { fs.begin(), fs.end() };
+    rhs.insert(polynomial { w });
+    buchberger(rhs);
+    return lhs == rhs;
+}
+
+} // namespace verify_details
+
+bool verify_basis(const ideal_basis& generators, const ideal_basis& basis,
+    const verify_options& options)
+{
+    using namespace verify_details;
+
+    if (options.rounds < 1)
+        throw std::invalid_argument("verify_basis: rounds must be at least 1");
+    if (basis.count(polynomial {}) != 0)
+        return false;
+    ideal_basis gens = generators;
+    gens.erase(polynomial {});
+    if (gens.empty() || basis.empty())
+        return gens.empty() && basis.empty();
+
+    // These only look at the claimed basis, and at the generators reduced
+    // modulo it, so they cost far less than computing the basis.  After
+    // them, basis is a reduced Groebner basis of an ideal containing the
+    // generators.
+    std::vector<polynomial> fs { basis.begin(), basis.end() };
+    if (!is_reduced_basis(fs))
+        return false;
+    for (const auto& g : gens)
+        if (!in_ideal(g, fs))
+            return false;
+
+    // Equal ideals have equal images mod every p, so a mismatch here is
+    // conclusive whatever the prime.
+    std::mt19937 rng(options.seed != 0 ? options.seed : std::random_device {}());
+    prime_source primes(rng);
+    for (int i = 0; i < options.rounds; ++i) {
+        word p = primes.next();
+        if (ideal_image(gens, p) != ideal_image(basis, p))
+            return false;
+    }
+
+    // That leaves showing that the ideal of basis is no larger.  If that
+    // cannot be done cheaply, recompute the basis.
+    if (basis_in_ideal(gens, fs, primes, rng, options))
+        return true;
+    ideal_basis b = std::move(gens);
+    groebner_basis(b);
+    return b == basis;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "buchberger.h"
+
+struct verify_options {
+    // Number of random word-size primes p at which the images of the two
+    // ideals in F_p[x] are compared, and for which a resultant computed by
+    // Chinese remaindering must stay unchanged before it is trusted; must
+    // be at least 1.
+    int rounds = 4;
+    // Run the Chinese remaindering up to the Hadamard bound instead, so
+    // that the answer is always right.
+    bool exact = false;
+    // Seed for choosing the primes and random combinations; 0 means take
+    // one from std::random_device.
+    unsigned seed = 0;
+};
+
+// Check whether basis is the reduced Groebner basis (as computed by
+// buchberger()) of the ideal generated by generators.
+//
+// This first checks exactly that basis is a reduced Groebner basis and
+// that every generator lies in the ideal it generates, then compares the
+// images of both ideals in F_p[x] for options.rounds random primes p.  All
+// of these only reduce modulo the claimed basis, so they are cheap, and a
+// failure is conclusive.  What is left is to show that the ideal of basis
+// is no larger than that of the generators; this compares the index of a
+// Sylvester matrix of two generators, which is a resultant computed modulo
+// word-size primes, with the one the claimed basis implies (see
+// basis_in_ideal() in verify.cpp).  If that is inconclusive, or the ideal
+// contains no nonzero integer, the basis is recomputed with
+// groebner_basis() instead.  Without options.exact, a wrong answer needs
+// the resultant to look stable for options.rounds primes in a row without
+// being right.
+bool verify_basis(const ideal_basis& generators, const ideal_basis& basis,
+    const verify_options& options = {});
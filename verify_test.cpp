@@ -0,0 +1,58 @@
+#include "verify.h"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+bool verify_of(const ideal_basis& generators, const ideal_basis& basis, bool exact)
+{
+    verify_options options;
+    options.exact = exact;
+    options.seed = 12345;
+    return verify_basis(generators, basis, options);
+}
+
+TEST(Verify, VerifyBasis)
+{
+    for (bool exact : { false, true }) {
+        EXPECT_TRUE(verify_of({}, {}, exact));
+        EXPECT_TRUE(verify_of({ {} }, {}, exact));
+        EXPECT_FALSE(verify_of({}, { { 2 } }, exact));
+        EXPECT_TRUE(verify_of({ { 16 }, { 10 } }, { { 2 } }, exact));
+        EXPECT_FALSE(verify_of({ { 16 }, { 10 } }, { { 4 } }, exact));
+        EXPECT_TRUE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 15 }, { 21 } }, exact));
+        EXPECT_TRUE(verify_of({ { -1, -3, -2 }, { 4, 4 } }, { { 1, 3, 2 }, { 4, 4 } }, exact));
+        EXPECT_TRUE(verify_of({ { 1, 0, 5 }, { 1, -1 }, { 2 } }, { { 1, 1 }, { 2 } }, exact));
+
+        // Same ideal, but not reduced
+        EXPECT_FALSE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 36 }, { 21 } }, exact));
+        EXPECT_FALSE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 15 }, { 21 }, { 42 } }, exact));
+        EXPECT_FALSE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 1, 0 }, { 4, -3 } }, exact));
+        // Ideals differing only at a prime which the random primes will
+        // never hit, smaller and larger than the right one
+        EXPECT_FALSE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 15 }, { 42 } }, exact));
+        EXPECT_FALSE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 1 }, { 7 } }, exact));
+        EXPECT_FALSE(verify_of({ { 2, 0 } }, { { 1, 0 } }, exact));
+        EXPECT_FALSE(verify_of({ { 6, 0, 0 } }, { { 1, 0, 0 } }, exact));
+        // Leading coefficients with a common factor
+        EXPECT_TRUE(verify_of({ { 2, 0, 1 }, { 2, 3 } }, { { 1, 7 }, { 11 } }, exact));
+        EXPECT_TRUE(verify_of({ { 2, 1 }, { 2, 3 } }, { { 1 } }, exact));
+        // Ideals differing over Q
+        EXPECT_FALSE(verify_of({ { 1, 0, -1 } }, { { 1, -1 } }, exact));
+        EXPECT_FALSE(verify_of({ { 1, 1, 0 }, { 4, -3 } }, { { 1, 0 } }, exact));
+        EXPECT_FALSE(verify_of({ { 2, 0, 0 }, { 3, 0, 0 } }, { { 1, 0 } }, exact));
+        EXPECT_TRUE(verify_of({ { 2, 0 }, { 4, 0, 0 } }, { { 2, 0 } }, exact));
+
+        EXPECT_TRUE(verify_of({ { 1, 0, 0, 5, 3, 0, 0, 0, 0, 0, 9, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0 },
+                                  { 3, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 1 } },
+            { { 1, 7747110435841547256507133_Z }, { 11529190147322608601758016_Z } }, exact));
+        EXPECT_FALSE(verify_of({ { 1, 0, 0, 5, 3, 0, 0, 0, 0, 0, 9, 0, 0, -3, 0, -1, 0, 0, 0, 0, 0, 0 },
+                                   { 3, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 1 } },
+            { { 1, 7747110435841547256507133_Z }, { 2 * 11529190147322608601758016_Z } }, exact));
+    }
+}
+
+TEST(Verify, Rounds)
+{
+    verify_options options;
+    options.rounds = 0;
+    EXPECT_THROW(verify_basis({ { 2 } }, { { 2 } }, options), std::invalid_argument);
+}